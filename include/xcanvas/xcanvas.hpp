@@ -15,6 +15,8 @@
 #include <functional>
 #include <list>
 #include <map>
+#include <optional>
+#include <stdexcept>
 #include <string>
 #include <utility>
 #include <vector>
@@ -173,7 +175,25 @@ namespace xc
         void bezier_curve_to(double cp1x, double cp1y, double cp2x, double cp2y, double x, double y);
 
         // Text methods
-        // TODO
+        void fill_text(const std::string& text, double x, double y);
+        void fill_text(const std::string& text, double x, double y, double max_width);
+        void stroke_text(const std::string& text, double x, double y);
+        void stroke_text(const std::string& text, double x, double y, double max_width);
+
+        // Batched text methods: label i is texts[offsets[i], offsets[i + 1])
+        // drawn at (x[i], y[i]), so offsets holds x.size() + 1 entries.
+        // The batch's fillText/strokeText commands are queued together and
+        // sent in one flush. Throws std::invalid_argument on mismatched sizes
+        // or offsets that are out of range, decreasing, or not on a UTF-8
+        // character boundary, in which case nothing is queued.
+        void fill_texts(const std::vector<double>& x, const std::vector<double>& y,
+                        const std::string& texts, const std::vector<std::size_t>& offsets);
+        void fill_texts(const std::vector<double>& x, const std::vector<double>& y,
+                        const std::string& texts, const std::vector<std::size_t>& offsets, double max_width);
+        void stroke_texts(const std::vector<double>& x, const std::vector<double>& y,
+                          const std::string& texts, const std::vector<std::size_t>& offsets);
+        void stroke_texts(const std::vector<double>& x, const std::vector<double>& y,
+                          const std::string& texts, const std::vector<std::size_t>& offsets, double max_width);
 
         // Line style methods
         // TODO
@@ -218,6 +238,8 @@ namespace xc
     private:
 
         void send_command(const nl::json& command);
+        void send_texts(p::COMMANDS command, const std::vector<double>& x, const std::vector<double>& y,
+                        const std::string& texts, const std::vector<std::size_t>& offsets, std::optional<double> max_width);
 
         nl::json m_commands;
         bool m_caching;
@@ -442,6 +464,62 @@ namespace xc
         send_command(nl::json::array({ p::COMMANDS::bezierCurveTo, { cp1x, cp1y, cp2x, cp2y, x, y } }));
     }
 
+    /*
+     * Text methods
+     */
+
+    template <class D>
+    inline void xcanvas<D>::fill_text(const std::string& text, double x, double y)
+    {
+        send_command(nl::json::array({ p::COMMANDS::fillText, { text, x, y } }));
+    }
+
+    template <class D>
+    inline void xcanvas<D>::fill_text(const std::string& text, double x, double y, double max_width)
+    {
+        send_command(nl::json::array({ p::COMMANDS::fillText, { text, x, y, max_width } }));
+    }
+
+    template <class D>
+    inline void xcanvas<D>::stroke_text(const std::string& text, double x, double y)
+    {
+        send_command(nl::json::array({ p::COMMANDS::strokeText, { text, x, y } }));
+    }
+
+    template <class D>
+    inline void xcanvas<D>::stroke_text(const std::string& text, double x, double y, double max_width)
+    {
+        send_command(nl::json::array({ p::COMMANDS::strokeText, { text, x, y, max_width } }));
+    }
+
+    template <class D>
+    inline void xcanvas<D>::fill_texts(const std::vector<double>& x, const std::vector<double>& y,
+                                       const std::string& texts, const std::vector<std::size_t>& offsets)
+    {
+        send_texts(p::COMMANDS::fillText, x, y, texts, offsets, std::nullopt);
+    }
+
+    template <class D>
+    inline void xcanvas<D>::fill_texts(const std::vector<double>& x, const std::vector<double>& y,
+                                       const std::string& texts, const std::vector<std::size_t>& offsets, double max_width)
+    {
+        send_texts(p::COMMANDS::fillText, x, y, texts, offsets, max_width);
+    }
+
+    template <class D>
+    inline void xcanvas<D>::stroke_texts(const std::vector<double>& x, const std::vector<double>& y,
+                                         const std::string& texts, const std::vector<std::size_t>& offsets)
+    {
+        send_texts(p::COMMANDS::strokeText, x, y, texts, offsets, std::nullopt);
+    }
+
+    template <class D>
+    inline void xcanvas<D>::stroke_texts(const std::vector<double>& x, const std::vector<double>& y,
+                                         const std::string& texts, const std::vector<std::size_t>& offsets, double max_width)
+    {
+        send_texts(p::COMMANDS::strokeText, x, y, texts, offsets, max_width);
+    }
+
     /*
      * Clip methods
      */
@@ -501,6 +579,47 @@ namespace xc
         }
     }
 
+    template <class D>
+    inline void xcanvas<D>::send_texts(p::COMMANDS command, const std::vector<double>& x, const std::vector<double>& y,
+                                       const std::string& texts, const std::vector<std::size_t>& offsets, std::optional<double> max_width)
+    {
+        if (y.size() != x.size() || offsets.size() != x.size() + 1)
+        {
+            throw std::invalid_argument("xcanvas: x, y and offsets sizes do not match");
+        }
+        for (std::size_t i = 0; i < offsets.size(); ++i)
+        {
+            if ((i > 0 && offsets[i - 1] > offsets[i]) || offsets[i] > texts.size())
+            {
+                throw std::invalid_argument("xcanvas: invalid text offsets");
+            }
+            if (offsets[i] < texts.size() && (static_cast<unsigned char>(texts[offsets[i]]) & 0xC0) == 0x80)
+            {
+                throw std::invalid_argument("xcanvas: text offset is not on a UTF-8 character boundary");
+            }
+        }
+
+        if (x.empty())
+        {
+            return;
+        }
+
+        for (std::size_t i = 0; i < x.size(); ++i)
+        {
+            nl::json args = nl::json::array({ texts.substr(offsets[i], offsets[i + 1] - offsets[i]), x[i], y[i] });
+            if (max_width)
+            {
+                args.push_back(*max_width);
+            }
+            m_commands.push_back(nl::json::array({ command, std::move(args) }));
+        }
+
+        if (!m_caching)
+        {
+            flush();
+        }
+    }
+
     template <class D>
     inline void xcanvas<D>::cache()
     {
@@ -513,13 +632,16 @@ namespace xc
         nl::json content;
         content["dtype"] = "uint8";
 
-        std::string buffer_str = m_commands.dump();
+        // Reset the queue before serializing, so that a command which fails
+        // to serialize (e.g. invalid UTF-8 text) does not stay queued
+        nl::json commands = nl::json::array();
+        std::swap(commands, m_commands);
+        m_caching = false;
+
+        std::string buffer_str = commands.dump();
         std::vector<char> buffer(buffer_str.begin(), buffer_str.end());
 
         this->send(std::move(content), { buffer });
-
-        m_commands.clear();
-        m_caching = false;
     }
 
     template <class D>